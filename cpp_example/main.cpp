@@ -1,6 +1,7 @@
 #include <cassert> 
 #include <cstdio>
 #include <cstdlib>
+#include <cmath>
 #include <vector>
 #include <map>
 #include "mir/interpolate.h"
@@ -24,6 +25,8 @@ void testSRCPtr();
 void testRCPtr();
 void testPM();
 void testFindRoot();
+void testNumeric();
+void testInterpolate();
 void testStringView();
 void testDestructorView();
 
@@ -105,6 +108,9 @@ int main()
     testSRCPtr();
     testRCPtr();
     testPM();
+    testFindRoot();
+    testNumeric();
+    testInterpolate();
     testStringView();
     testDestructorView();
 
@@ -215,6 +221,51 @@ void testFindRoot()
 
     // with relative tolerance
     assert(mir_find_root(func, 1e-6, a, b).validate().x());
+
+    // many problems x * x = targets[i]
+    double targets[] = {1, 4, 9, 16};
+    double as[] = {0, 0, 0, 0};
+    double bs[] = {10, 10, 10, 10};
+    mir_find_root_result<double> results[4];
+    std::function<void(size_t, size_t, const double*, double*)> batch =
+        [&targets](size_t offset, size_t length, const double* x, double* y) {
+            for (size_t i = 0; i < length; i++)
+                y[i] = x[i] * x[i] - targets[offset + i];
+        };
+    mir_find_root_batch(batch, tolerance, 4, as, bs, results);
+    for (size_t i = 0; i < 4; i++)
+        assert(std::fabs(results[i].validate().x() - (i + 1)) < 1e-6);
+}
+
+void testNumeric()
+{
+    // lambdas are passed without std::function
+    auto parabola = [](double x) { return (x - 1) * (x - 1) - 4; };
+
+    auto min = mir_find_local_min(parabola, -10.0, 10.0).validate();
+    assert(std::fabs(min.x - 1) < 1e-6);
+
+    auto smile = mir_find_smile_roots(parabola, -10.0, 10.0).validate();
+    assert(smile.hasLeftResult && smile.hasRightResult);
+    assert(std::fabs(smile.leftResult.x() + 1) < 1e-6);
+    assert(std::fabs(smile.rightResult.x() - 3) < 1e-6);
+
+    assert(std::fabs(mir_integrate(parabola, 0.0, 3.0) + 9) < 1e-10);
+    assert(std::fabs(mir_diff(parabola, 2.0, 0.1).value - 2) < 1e-10);
+}
+
+void testInterpolate()
+{
+    const double grid[] = {0, 1, 2, 4};
+    const double values[] = {1, 3, 2, 6};
+    const double xs[] = {-1, 0.5, 1, 1.5, 3, 5};
+    double results[6];
+
+    mir_interpolate_linear(4, grid, values, 6, xs, results, true);
+    assert(results[0] == -1 && results[1] == 2 && results[3] == 2.5 && results[5] == 8);
+
+    mir_interpolate_constant(4, grid, values, 6, xs, results, true);
+    assert(results[0] == 1 && results[1] == 1 && results[2] == 3 && results[4] == 2 && results[5] == 6);
 }
 
 void testStringView()
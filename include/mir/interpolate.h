@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 namespace mir {
     namespace interpolate
     {
@@ -33,3 +35,75 @@ namespace mir {
         };
     }
 }
+
+/**
+Evaluates the linear interpolant with nodes `grid` and values `values` at each of `xs`.
+Sorted points (`sorted = true`) are located with a single merge-walk, the others use the binary search.
+The `sorted` hint doesn't change the results.
+`gridLength` should be at least 2.
+*/
+void mir_interpolate_linear(
+    size_t gridLength,
+    const float* grid,
+    const float* values,
+    size_t length,
+    const float* xs,
+    float* results,
+    bool sorted = false
+);
+
+void mir_interpolate_linear(
+    size_t gridLength,
+    const double* grid,
+    const double* values,
+    size_t length,
+    const double* xs,
+    double* results,
+    bool sorted = false
+);
+
+void mir_interpolate_linear(
+    size_t gridLength,
+    const long double* grid,
+    const long double* values,
+    size_t length,
+    const long double* xs,
+    long double* results,
+    bool sorted = false
+);
+
+/**
+Evaluates the constant interpolant with nodes `grid` and values `values` at each of `xs`.
+Sorted points (`sorted = true`) are located with a single merge-walk, the others use the binary search.
+The `sorted` hint doesn't change the results.
+`gridLength` should be at least 1.
+*/
+void mir_interpolate_constant(
+    size_t gridLength,
+    const float* grid,
+    const float* values,
+    size_t length,
+    const float* xs,
+    float* results,
+    bool sorted = false
+);
+
+void mir_interpolate_constant(
+    size_t gridLength,
+    const double* grid,
+    const double* values,
+    size_t length,
+    const double* xs,
+    double* results,
+    bool sorted = false
+);
+
+void mir_interpolate_constant(
+    size_t gridLength,
+    const long double* grid,
+    const long double* values,
+    size_t length,
+    const long double* xs,
+    long double* results,
+    bool sorted = false
+);
@@ -2,8 +2,11 @@
 
 #define MIR_NUMERIC
 
+#include <cmath>
+#include <cstddef>
 #include <functional>
 #include <limits>
+#include <stdexcept>
 
 enum class mir_find_root_status
 {
@@ -68,6 +71,81 @@ struct mir_find_root_result
     T y() const noexcept;
 };
 
+template<class T>
+struct mir_find_local_min_result
+{
+    T x = 0;
+    T y = 0;
+    T error = 0;
+
+    /**
+    Returns: self
+    Throws: `std::domain_error` if `status()` isn't `mir_find_root_status::success`.
+    */
+    const mir_find_local_min_result& validate() const
+    {
+        switch(status())
+        {
+            case mir_find_root_status::success: return *this;
+            case mir_find_root_status::nanX: throw std::domain_error("findLocalMin: ax or bx is NaN.");
+            case mir_find_root_status::nanY: throw std::domain_error("findLocalMin: f(x) returned NaN.");
+            default: throw std::domain_error("findLocalMin: unknown error.");
+        }
+    }
+
+    /**
+    Returns: `mir_find_root_status`
+    */
+    mir_find_root_status status() const noexcept;
+};
+
+template<class T>
+struct mir_find_smile_roots_result
+{
+    /// Left result if any
+    mir_find_root_result<T> leftResult;
+    /// Right result if any
+    mir_find_root_result<T> rightResult;
+    mir_find_local_min_result<T> localMinResult;
+    bool hasLeftResult = false;
+    bool hasRightResult = false;
+    bool hasLocalMinResult = false;
+
+    mir_find_root_status status() const noexcept
+    {
+        if (hasLeftResult && leftResult.status() != mir_find_root_status::success)
+            return leftResult.status();
+        if (hasRightResult && rightResult.status() != mir_find_root_status::success)
+            return rightResult.status();
+        if (!hasLeftResult && !hasRightResult)
+            return mir_find_root_status::badBounds;
+        return mir_find_root_status::success;
+    }
+
+    /**
+    Returns: self
+    Throws: `std::domain_error` if `status()` isn't `mir_find_root_status::success`.
+    */
+    const mir_find_smile_roots_result& validate() const
+    {
+        switch(status())
+        {
+            case mir_find_root_status::success: return *this;
+            case mir_find_root_status::badBounds: throw std::domain_error("findSmileRoots: f(ax) and f(bx) must have opposite signs to bracket the root.");
+            case mir_find_root_status::nanX: throw std::domain_error("findSmileRoots: ax or bx is NaN.");
+            case mir_find_root_status::nanY: throw std::domain_error("findSmileRoots: f(x) returned NaN.");
+            default: throw std::domain_error("findSmileRoots: unknown error.");
+        }
+    }
+};
+
+template<class T>
+struct mir_diff_result
+{
+    T value = 0;
+    T error = 0;
+};
+
 template<class T>
 T mir_internal_find_root_f(const void* ctx, T x)
 {
@@ -183,4 +261,290 @@ mir_find_root_result<T> mir_find_root(
     );
 }
 
+void mir_find_root_batch(
+    size_t length,
+    const float* ax,
+    const float* bx,
+    const float* fax, // can be NULL
+    const float* fbx, // can be NULL
+    mir_find_root_result<float>* results,
+    unsigned int maxIterations,
+    void (*f)(const void* ctx, size_t offset, size_t length, const float* x, float* y),
+    const void* f_ctx = NULL,
+    bool (*tolerance)(const void* ctx, float a, float b) = NULL,
+    const void* tolerance_ctx = NULL
+);
+
+void mir_find_root_batch(
+    size_t length,
+    const double* ax,
+    const double* bx,
+    const double* fax, // can be NULL
+    const double* fbx, // can be NULL
+    mir_find_root_result<double>* results,
+    unsigned int maxIterations,
+    void (*f)(const void* ctx, size_t offset, size_t length, const double* x, double* y),
+    const void* f_ctx = NULL,
+    bool (*tolerance)(const void* ctx, double a, double b) = NULL,
+    const void* tolerance_ctx = NULL
+);
+
+void mir_find_root_batch(
+    size_t length,
+    const long double* ax,
+    const long double* bx,
+    const long double* fax, // can be NULL
+    const long double* fbx, // can be NULL
+    mir_find_root_result<long double>* results,
+    unsigned int maxIterations,
+    void (*f)(const void* ctx, size_t offset, size_t length, const long double* x, long double* y),
+    const void* f_ctx = NULL,
+    bool (*tolerance)(const void* ctx, long double a, long double b) = NULL,
+    const void* tolerance_ctx = NULL
+);
+
+template<class T>
+void mir_internal_find_root_batch_f(const void* ctx, size_t offset, size_t length, const T* x, T* y)
+{
+    (*((const std::function<void(size_t, size_t, const T*, T*)>*)ctx))(offset, length, x, y);
+}
+
+/**
+Solves `length` independent problems in lock-step.
+`f(offset, n, x, y)` should set `y[i]` to the value of the function of the problem `offset + i` at `x[i]`, for `i < n`.
+*/
+template<class T>
+void mir_find_root_batch(
+    const std::function<void(size_t, size_t, const T*, T*)>& f,
+    const std::function<bool(T, T)>& tolerance,
+    size_t length,
+    const T* a,
+    const T* b,
+    mir_find_root_result<T>* results,
+    const T* fa = NULL,
+    const T* fb = NULL,
+    unsigned int maxIterations = sizeof(T) * 16
+)
+{
+    mir_find_root_batch(
+        length,
+        a,
+        b,
+        fa,
+        fb,
+        results,
+        maxIterations,
+        &mir_internal_find_root_batch_f<T>,
+        &f,
+        tolerance ? &mir_internal_find_root_tolerance<T> : NULL,
+        &tolerance
+    );
+}
+
+mir_find_local_min_result<float> mir_find_local_min(
+    float ax,
+    float bx,
+    float relTolerance,
+    float absTolerance,
+    size_t n,
+    float (*f)(const void* ctx, float x),
+    const void* f_ctx = NULL
+);
+
+mir_find_smile_roots_result<float> mir_find_smile_roots(
+    float ax,
+    float bx,
+    float fax,
+    float fbx,
+    float relTolerance,
+    float absTolerance,
+    unsigned int maxIterations,
+    float (*f)(const void* ctx, float x),
+    const void* f_ctx = NULL,
+    bool (*tolerance)(const void* ctx, float a, float b) = NULL,
+    const void* tolerance_ctx = NULL
+);
+
+float mir_integrate(
+    float a,
+    float b,
+    float tolerance,
+    float (*f)(const void* ctx, float x),
+    const void* f_ctx = NULL
+);
+
+mir_diff_result<float> mir_diff(
+    float x,
+    float h,
+    float factor,
+    float safe,
+    float (*f)(const void* ctx, float x),
+    const void* f_ctx = NULL
+);
+
+mir_find_local_min_result<double> mir_find_local_min(
+    double ax,
+    double bx,
+    double relTolerance,
+    double absTolerance,
+    size_t n,
+    double (*f)(const void* ctx, double x),
+    const void* f_ctx = NULL
+);
+
+mir_find_smile_roots_result<double> mir_find_smile_roots(
+    double ax,
+    double bx,
+    double fax,
+    double fbx,
+    double relTolerance,
+    double absTolerance,
+    unsigned int maxIterations,
+    double (*f)(const void* ctx, double x),
+    const void* f_ctx = NULL,
+    bool (*tolerance)(const void* ctx, double a, double b) = NULL,
+    const void* tolerance_ctx = NULL
+);
+
+double mir_integrate(
+    double a,
+    double b,
+    double tolerance,
+    double (*f)(const void* ctx, double x),
+    const void* f_ctx = NULL
+);
+
+mir_diff_result<double> mir_diff(
+    double x,
+    double h,
+    double factor,
+    double safe,
+    double (*f)(const void* ctx, double x),
+    const void* f_ctx = NULL
+);
+
+mir_find_local_min_result<long double> mir_find_local_min(
+    long double ax,
+    long double bx,
+    long double relTolerance,
+    long double absTolerance,
+    size_t n,
+    long double (*f)(const void* ctx, long double x),
+    const void* f_ctx = NULL
+);
+
+mir_find_smile_roots_result<long double> mir_find_smile_roots(
+    long double ax,
+    long double bx,
+    long double fax,
+    long double fbx,
+    long double relTolerance,
+    long double absTolerance,
+    unsigned int maxIterations,
+    long double (*f)(const void* ctx, long double x),
+    const void* f_ctx = NULL,
+    bool (*tolerance)(const void* ctx, long double a, long double b) = NULL,
+    const void* tolerance_ctx = NULL
+);
+
+long double mir_integrate(
+    long double a,
+    long double b,
+    long double tolerance,
+    long double (*f)(const void* ctx, long double x),
+    const void* f_ctx = NULL
+);
+
+mir_diff_result<long double> mir_diff(
+    long double x,
+    long double h,
+    long double factor,
+    long double safe,
+    long double (*f)(const void* ctx, long double x),
+    const void* f_ctx = NULL
+);
+
+// The wrappers below pass the callable by pointer as the context,
+// so lambdas are called directly without type erasure.
+
+template<class T, class F>
+T mir_internal_call_f(const void* ctx, T x)
+{
+    return (*((const F*)ctx))(x);
+}
+
+template<class T, class F>
+bool mir_internal_call_tolerance(const void* ctx, T a, T b)
+{
+    return (*((const F*)ctx))(a, b);
+}
+
+template<class T, class F>
+inline mir_find_local_min_result<T> mir_find_local_min(
+    const F& f,
+    const T ax,
+    const T bx,
+    const T relTolerance = std::sqrt(std::numeric_limits<T>::epsilon()),
+    const T absTolerance = std::sqrt(std::numeric_limits<T>::epsilon()),
+    size_t n = 0
+)
+{
+    return mir_find_local_min(ax, bx, relTolerance, absTolerance, n, &mir_internal_call_f<T, F>, &f);
+}
+
+template<class T, class F>
+inline mir_find_smile_roots_result<T> mir_find_smile_roots(
+    const F& f,
+    const T ax,
+    const T bx,
+    const T fax = std::numeric_limits<T>::quiet_NaN(),
+    const T fbx = std::numeric_limits<T>::quiet_NaN(),
+    const T relTolerance = std::sqrt(std::numeric_limits<T>::epsilon()),
+    const T absTolerance = std::sqrt(std::numeric_limits<T>::epsilon()),
+    unsigned int maxIterations = sizeof(T) * 16
+)
+{
+    return mir_find_smile_roots(ax, bx, fax, fbx, relTolerance, absTolerance, maxIterations, &mir_internal_call_f<T, F>, &f);
+}
+
+template<class T, class F, class G>
+inline mir_find_smile_roots_result<T> mir_find_smile_roots(
+    const F& f,
+    const G& tolerance,
+    const T ax,
+    const T bx,
+    const T fax = std::numeric_limits<T>::quiet_NaN(),
+    const T fbx = std::numeric_limits<T>::quiet_NaN(),
+    const T relTolerance = std::sqrt(std::numeric_limits<T>::epsilon()),
+    const T absTolerance = std::sqrt(std::numeric_limits<T>::epsilon()),
+    unsigned int maxIterations = sizeof(T) * 16
+)
+{
+    return mir_find_smile_roots(ax, bx, fax, fbx, relTolerance, absTolerance, maxIterations,
+        &mir_internal_call_f<T, F>, &f, &mir_internal_call_tolerance<T, G>, &tolerance);
+}
+
+template<class T, class F>
+inline T mir_integrate(
+    const F& f,
+    const T a,
+    const T b,
+    const T tolerance = std::numeric_limits<T>::epsilon()
+)
+{
+    return mir_integrate(a, b, tolerance, &mir_internal_call_f<T, F>, &f);
+}
+
+template<class T, class F>
+inline mir_diff_result<T> mir_diff(
+    const F& f,
+    const T x,
+    const T h,
+    const T factor = std::sqrt(T(2)),
+    const T safe = 2
+)
+{
+    return mir_diff(x, h, factor, safe, &mir_internal_call_f<T, F>, &f);
+}
+
 #endif